@@ -0,0 +1,31 @@
+#ifndef INCLUDE_ATTACH_UNIQUE_HPP_7B2E4C19_3A8D_4F61_B0C5_9D1E6A2F8C37
+#define INCLUDE_ATTACH_UNIQUE_HPP_7B2E4C19_3A8D_4F61_B0C5_9D1E6A2F8C37
+
+#include <cassert>
+#include <iostream>
+#include <memory>
+#include <typeinfo>
+
+#include <wayland-client.h>
+
+template <class T, class D>
+auto attach_unique(T* ptr, D deleter) noexcept {
+    assert(ptr);
+    return std::unique_ptr<T, D>(ptr, deleter);
+}
+template <class WL_TYPE>
+auto attach_unique(WL_TYPE* ptr) noexcept {
+    assert(ptr);
+    constexpr static auto deleter = [](WL_TYPE* ptr) noexcept {
+        std::cout << typeid (ptr).name() << ':' << ptr << " deleted as proxy" << std::endl;
+        wl_proxy_destroy(reinterpret_cast<wl_proxy*>(ptr));
+    };
+    return std::unique_ptr<WL_TYPE, decltype (deleter)>(ptr, deleter);
+}
+inline auto attach_unique(wl_display* ptr) noexcept {
+    assert(ptr);
+    constexpr static auto deleter = wl_display_disconnect;
+    return std::unique_ptr<wl_display, decltype (deleter)>(ptr, deleter);
+}
+
+#endif/*INCLUDE_ATTACH_UNIQUE_HPP_7B2E4C19_3A8D_4F61_B0C5_9D1E6A2F8C37*/
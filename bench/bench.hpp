@@ -0,0 +1,117 @@
+#ifndef INCLUDE_BENCH_HPP_1E5D9B3A_6F0C_4B27_9A41_2C8E7D5F0B64
+#define INCLUDE_BENCH_HPP_1E5D9B3A_6F0C_4B27_9A41_2C8E7D5F0B64
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace bench
+{
+
+template <class T>
+inline void do_not_optimize(T const& value) noexcept {
+    asm volatile ("" : : "r,m" (value) : "memory");
+}
+
+struct state {
+    std::size_t iterations = 1;
+    std::size_t items = 0;      // items processed per iteration
+    std::size_t items_total = 0;    // overrides `items` with a count over the whole run
+    std::size_t counter = 0;    // free-form counter reported per iteration (e.g. resumes)
+    std::optional<std::chrono::nanoseconds> manual_time;    // overrides wall time when set
+    bool skipped = false;       // set when the environment cannot run the body
+};
+
+// Swallows std::cout for its lifetime, for bodies whose code under test logs.
+struct silence_cout {
+    struct null_buffer : std::streambuf {
+        int overflow(int c) override { return c; }
+    };
+    null_buffer buffer_;
+    std::streambuf* saved_ = std::cout.rdbuf(&this->buffer_);
+    ~silence_cout() { std::cout.rdbuf(this->saved_); }
+};
+
+struct entry {
+    std::string name;
+    std::function<void(state&)> body;
+};
+
+inline auto& registry() {
+    static std::vector<entry> entries;
+    return entries;
+}
+
+struct registrar {
+    registrar(std::string name, std::function<void(state&)> body) {
+        registry().push_back({std::move(name), std::move(body)});
+    }
+};
+
+// Doubles the iteration count until a run takes at least `min_time`, then
+// reports the time per iteration and, when the body sets `items`, per item.
+// Bodies with expensive setup time themselves through `manual_time`.
+inline void run(entry const& e,
+                std::chrono::nanoseconds min_time = std::chrono::milliseconds(200))
+{
+    using clock = std::chrono::steady_clock;
+    state st;
+    for (;;) {
+        st.items = 0;
+        st.items_total = 0;
+        st.counter = 0;
+        st.manual_time.reset();
+        auto t0 = clock::now();
+        e.body(st);
+        std::chrono::nanoseconds elapsed = clock::now() - t0;
+        if (st.skipped) {
+            std::cout << std::left << std::setw(48) << e.name << "skipped" << std::endl;
+            return;
+        }
+        if (st.manual_time) {
+            elapsed = *st.manual_time;
+        }
+        if (elapsed >= min_time || st.iterations >= (std::size_t(1) << 40)) {
+            double ns = std::chrono::duration<double, std::nano>(elapsed).count() / st.iterations;
+            std::cout << std::left << std::setw(48) << e.name
+                      << std::right << std::setw(14) << std::fixed << std::setprecision(1) << ns << " ns/iter";
+            double items = st.items_total ? double(st.items_total) / st.iterations : double(st.items);
+            if (items) {
+                std::cout << std::setw(12) << std::setprecision(3) << ns / items << " ns/item"
+                          << std::setw(14) << std::setprecision(1) << 1e9 * items / ns << " items/s";
+            }
+            if (st.counter) {
+                std::cout << std::setw(12) << st.counter << " count/iter";
+            }
+            std::cout << std::endl;
+            return;
+        }
+        st.iterations *= 2;
+    }
+}
+
+inline int main(int argc, char** argv) {
+    std::string_view filter = argc > 1 ? argv[1] : "";
+    for (auto const& e : registry()) {
+        if (e.name.find(filter) != std::string::npos) {
+            run(e);
+        }
+    }
+    return 0;
+}
+
+} // end of namespace bench
+
+#define BENCH_CONCAT_IMPL(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_IMPL(a, b)
+#define BENCHMARK(name, ...) \
+    static ::bench::registrar BENCH_CONCAT(bench_registrar_, __LINE__){(name), (__VA_ARGS__)}
+
+#endif/*INCLUDE_BENCH_HPP_1E5D9B3A_6F0C_4B27_9A41_2C8E7D5F0B64*/
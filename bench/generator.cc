@@ -0,0 +1,121 @@
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+#include "experimental_generator.hpp"
+#include "bench.hpp"
+
+namespace
+{
+
+// Not a multiple of any batch size below, so the partial final chunk is
+// always exercised.
+constexpr std::size_t stream_length = (1 << 16) + 7;
+
+std::generator<std::uint32_t> pixels(std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        co_yield static_cast<std::uint32_t>(i * 2654435761u);
+    }
+}
+
+template <std::size_t N>
+std::batched_generator<std::uint32_t, N> pixels_batched(std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        co_yield static_cast<std::uint32_t>(i * 2654435761u);
+    }
+}
+
+// Order-sensitive, so dropped, duplicated or reordered elements show up.
+inline std::uint32_t fold(std::uint32_t acc, std::uint32_t v) noexcept {
+    return (acc ^ v) * 16777619u;
+}
+
+std::uint32_t per_element_sum(std::size_t n, std::size_t& resumes) {
+    std::uint32_t acc = 2166136261u;
+    resumes = 1;
+    for (auto v : pixels(n)) {
+        acc = fold(acc, v);
+        ++resumes;
+    }
+    return acc;
+}
+
+template <std::size_t N>
+std::uint32_t chunked_sum(std::size_t n, std::size_t& resumes) {
+    std::uint32_t acc = 2166136261u;
+    resumes = 1;
+    for (auto chunk : pixels_batched<N>(n)) {
+        for (auto v : chunk) {
+            acc = fold(acc, v);
+        }
+        ++resumes;
+    }
+    return acc;
+}
+
+template <std::size_t N>
+std::uint32_t flattened_sum(std::size_t n) {
+    std::uint32_t acc = 2166136261u;
+    auto gen = pixels_batched<N>(n);
+    for (auto v : gen.elements()) {
+        acc = fold(acc, v);
+    }
+    return acc;
+}
+
+// Checks the batched generator against std::generator once per batch size,
+// including the empty stream and lengths around the batch boundary.
+template <std::size_t N>
+void verify() {
+    static bool const verified = [] {
+        for (std::size_t n : { std::size_t(0), std::size_t(1), N - 1, N, N + 1, stream_length }) {
+            std::size_t resumes = 0;
+            std::size_t chunk_resumes = 0;
+            auto expected = per_element_sum(n, resumes);
+            assert(resumes == n + 1);
+            assert(chunked_sum<N>(n, chunk_resumes) == expected);
+            assert(chunk_resumes == (n + N - 1) / N + 1);
+            assert(flattened_sum<N>(n) == expected);
+        }
+        return true;
+    }();
+    bench::do_not_optimize(verified);
+}
+
+BENCHMARK("generator/per-element", [](bench::state& st) {
+    std::size_t resumes = 0;
+    for (std::size_t it = 0; it < st.iterations; ++it) {
+        bench::do_not_optimize(per_element_sum(stream_length, resumes));
+    }
+    st.items = stream_length;
+    st.counter = resumes;
+});
+
+template <std::size_t N>
+void chunked(bench::state& st) {
+    verify<N>();
+    std::size_t resumes = 0;
+    for (std::size_t it = 0; it < st.iterations; ++it) {
+        bench::do_not_optimize(chunked_sum<N>(stream_length, resumes));
+    }
+    st.items = stream_length;
+    st.counter = resumes;
+}
+
+template <std::size_t N>
+void flattened(bench::state& st) {
+    verify<N>();
+    for (std::size_t it = 0; it < st.iterations; ++it) {
+        bench::do_not_optimize(flattened_sum<N>(stream_length));
+    }
+    st.items = stream_length;
+}
+
+BENCHMARK("generator/batched<16>/chunks", chunked<16>);
+BENCHMARK("generator/batched<256>/chunks", chunked<256>);
+BENCHMARK("generator/batched<4096>/chunks", chunked<4096>);
+BENCHMARK("generator/batched<16>/elements", flattened<16>);
+BENCHMARK("generator/batched<256>/elements", flattened<256>);
+BENCHMARK("generator/batched<4096>/elements", flattened<4096>);
+
+} // end of anonymous namespace
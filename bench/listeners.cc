@@ -0,0 +1,66 @@
+#include <iterator>
+
+#include "listeners.hpp"
+#include "bench.hpp"
+
+namespace
+{
+
+// These call the handler bodies through the listener tables with null
+// proxies; libwayland's closure marshalling and dispatch are not included.
+
+constexpr std::size_t events = 1024;
+
+BENCHMARK("listener-handlers/pointer.motion", [](bench::state& st) {
+    // The handlers log every event; the output is discarded, but formatting
+    // it is part of the handler and stays in the measurement.
+    bench::silence_cout silence;
+    wlxx::view_state state;
+    wlxx::input_focus focus = { .pointer = &state };
+    auto listener = &wlxx::pointer_listener;
+    bench::do_not_optimize(listener);
+    for (std::size_t it = 0; it < st.iterations; ++it) {
+        for (std::size_t i = 0; i < events; ++i) {
+            listener->motion(&focus, nullptr, i,
+                             wl_fixed_from_int(i % 800),
+                             wl_fixed_from_int(i % 600));
+        }
+        bench::do_not_optimize(state.pointer[0]);
+    }
+    st.items = events;
+});
+
+BENCHMARK("listener-handlers/keyboard.key", [](bench::state& st) {
+    bench::silence_cout silence;
+    wlxx::input_focus focus;
+    auto listener = &wlxx::keyboard_listener;
+    bench::do_not_optimize(listener);
+    for (std::size_t it = 0; it < st.iterations; ++it) {
+        for (std::size_t i = 0; i < events; ++i) {
+            listener->key(&focus, nullptr, i, i, 2 + i % 64, i & 1);
+        }
+        bench::do_not_optimize(focus.scancode);
+    }
+    st.items = events;
+});
+
+// Interfaces the client does not bind: exercises only the name matching.
+BENCHMARK("listener-handlers/registry.global(unbound)", [](bench::state& st) {
+    static char const* const interfaces[] = {
+        "wl_shm", "wl_data_device_manager", "xdg_wm_base", "wl_output",
+        "zwp_linux_dmabuf_v1", "wp_viewporter", "wl_subcompositor",
+    };
+    constexpr std::size_t count = std::size(interfaces);
+    wlxx::globals globals;
+    auto listener = &wlxx::registry_listener;
+    bench::do_not_optimize(listener);
+    for (std::size_t it = 0; it < st.iterations; ++it) {
+        for (std::size_t i = 0; i < events; ++i) {
+            listener->global(&globals, nullptr, i, interfaces[i % count], 1);
+        }
+        bench::do_not_optimize(globals);
+    }
+    st.items = events;
+});
+
+} // end of anonymous namespace
@@ -0,0 +1,5 @@
+#include "bench.hpp"
+
+int main(int argc, char** argv) {
+    return bench::main(argc, argv);
+}
@@ -0,0 +1,85 @@
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "render.hpp"
+#include "bench.hpp"
+
+namespace
+{
+
+struct resolution {
+    char const* name;
+    int width;
+    int height;
+};
+
+constexpr resolution resolutions[] = {
+    { "320x240",    320,  240 },
+    { "800x600",    800,  600 },
+    { "1920x1080", 1920, 1080 },
+    { "3840x2160", 3840, 2160 },
+};
+
+void shade_host(bench::state& st, int width, int height) {
+    std::vector<std::uint32_t> pixels(std::size_t(width) * height);
+    float pointer[2] = { width / 3.0f, height / 3.0f };
+    for (std::size_t it = 0; it < st.iterations; ++it) {
+        wlxx::render::shade(pixels, width, height, pointer);
+        bench::do_not_optimize(pixels.data());
+    }
+    st.items = pixels.size();
+}
+
+sycl::queue* default_queue() {
+    static auto instance = []() -> std::unique_ptr<sycl::queue> {
+        try {
+            return std::make_unique<sycl::queue>();
+        }
+        catch (std::exception& ex) {
+            std::cerr << "render/shade/sycl: " << ex.what() << std::endl;
+            return nullptr;
+        }
+    }();
+    return instance.get();
+}
+
+void shade_sycl(bench::state& st, int width, int height) {
+    auto q = default_queue();
+    if (!q) {
+        st.skipped = true;
+        return;
+    }
+    auto& queue = *q;
+    auto count = std::size_t(width) * height;
+    auto pixels = sycl::malloc_shared<std::uint32_t>(count, queue);
+    if (!pixels) {
+        // The device does not support shared USM allocations.
+        st.skipped = true;
+        return;
+    }
+    float pointer[2] = { width / 3.0f, height / 3.0f };
+    for (std::size_t it = 0; it < st.iterations; ++it) {
+        wlxx::render::shade(queue, pixels, width, height, pointer);
+        bench::do_not_optimize(pixels);
+    }
+    sycl::free(pixels, queue);
+    st.items = count;
+}
+
+struct register_resolutions {
+    register_resolutions() {
+        for (auto const& r : resolutions) {
+            auto w = r.width;
+            auto h = r.height;
+            bench::registrar(std::string("render/shade/host/") + r.name,
+                             [w, h](bench::state& st) { shade_host(st, w, h); });
+            bench::registrar(std::string("render/shade/sycl/") + r.name,
+                             [w, h](bench::state& st) { shade_sycl(st, w, h); });
+        }
+    }
+} register_resolutions_;
+
+} // end of anonymous namespace
@@ -0,0 +1,107 @@
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "window.hpp"
+#include "bench.hpp"
+
+namespace
+{
+
+struct environment {
+    wlxx::connection conn;
+    wlxx::egl_shared shared{conn.display()};
+};
+
+environment* env() {
+    static auto instance = []() -> std::unique_ptr<environment> {
+        try {
+            return std::make_unique<environment>();
+        }
+        catch (std::exception& ex) {
+            std::cerr << "windows: " << ex.what() << std::endl;
+            return nullptr;
+        }
+    }();
+    return instance.get();
+}
+
+// Unthrottled windows each rendering on their own thread; `iterations` is
+// the minimum number of frames per window, and items/s is the aggregate
+// frame rate.
+void aggregate_frames(bench::state& st, int count) {
+    using clock = std::chrono::steady_clock;
+    // Proxy deleters log every surface torn down between runs.
+    bench::silence_cout silence;
+    auto e = env();
+    if (!e) {
+        st.skipped = true;
+        return;
+    }
+    std::vector<std::unique_ptr<wlxx::window>> windows;
+    for (int i = 0; i < count; ++i) {
+        windows.push_back(std::make_unique<wlxx::window>(e->conn, e->shared, 320, 240, "wlxx-bench"));
+    }
+    wl_display_roundtrip(e->conn.display());
+    for (auto& w : windows) {
+        w->start(false);
+    }
+    auto total = [&] {
+        std::uint64_t frames = 0;
+        for (auto& w : windows) {
+            frames += w->frames();
+        }
+        return frames;
+    };
+    auto alive = [&] {
+        for (auto& w : windows) {
+            if (!w->running()) return false;
+        }
+        return true;
+    };
+    // Warm up until every window has swapped once.
+    for (auto& w : windows) {
+        while (alive() && 0 == w->frames()) {
+            e->conn.dispatch(1);
+        }
+    }
+    auto frames0 = total();
+    std::vector<std::uint64_t> starts;
+    for (auto& w : windows) {
+        starts.push_back(w->frames());
+    }
+    auto done = [&] {
+        for (std::size_t i = 0; i < windows.size(); ++i) {
+            if (windows[i]->frames() - starts[i] < st.iterations) return false;
+        }
+        return true;
+    };
+    auto t0 = clock::now();
+    while (alive() && !done()) {
+        e->conn.dispatch(1);
+    }
+    // Render threads keep going until the loop notices, so count what was
+    // actually rendered when the clock stops.
+    auto frames1 = total();
+    st.manual_time = clock::now() - t0;
+    st.skipped = !alive();
+    for (auto& w : windows) {
+        w->stop();
+    }
+    st.items_total = frames1 - frames0;
+}
+
+struct register_window_counts {
+    register_window_counts() {
+        for (int n = 1; n <= 8; ++n) {
+            bench::registrar("render/windows/" + std::to_string(n),
+                             [n](bench::state& st) { aggregate_frames(st, n); });
+        }
+    }
+} register_window_counts_;
+
+} // end of anonymous namespace
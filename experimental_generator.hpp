@@ -3,6 +3,11 @@
 
 #include <type_traits>
 #include <memory>
+#include <array>
+#include <span>
+#include <ranges>
+#include <iterator>
+#include <utility>
 
 namespace std::experimental
 {
@@ -319,6 +324,182 @@ private:
     std::coroutine_handle<promise_type> coro_ = nullptr;
 };
 
+/////////////////////////////////////////////////////////////////////////////
+// batched_generator<T, N>
+//
+// The producer still writes `co_yield value;` per element, but the value is
+// appended to a fixed-capacity buffer in the promise and the coroutine only
+// suspends once the buffer is full (or on completion, with a partial chunk).
+// Iterating the generator itself yields std::span<T> chunks; elements() is a
+// flattening view over the same stream that is a std::ranges::input_range.
+// Resumes per element drop from 1 to 1/N.
+
+template <class T, std::size_t N = 256>
+struct batched_generator {
+    static_assert(N > 0);
+
+    using value_type = std::remove_cvref_t<T>;
+    static constexpr std::size_t capacity = N;
+
+    struct promise_type {
+        std::array<value_type, N> buffer_;
+        std::size_t size_ = 0;
+
+        struct yield_awaiter {
+            bool ready_;
+            bool await_ready() const noexcept { return this->ready_; }
+            void await_suspend(std::coroutine_handle<void>) const noexcept { }
+            void await_resume() const noexcept { }
+        };
+
+        batched_generator get_return_object() noexcept { return batched_generator{*this}; }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend()   noexcept { return {}; }
+        void unhandled_exception() { throw; }
+        yield_awaiter yield_value(value_type const& value) noexcept(std::is_nothrow_copy_assignable_v<value_type>) {
+            this->buffer_[this->size_++] = value;
+            return {this->size_ < N};
+        }
+        yield_awaiter yield_value(value_type&& value) noexcept(std::is_nothrow_move_assignable_v<value_type>) {
+            this->buffer_[this->size_++] = std::move(value);
+            return {this->size_ < N};
+        }
+        void return_void() noexcept { }
+
+        std::span<value_type> chunk() noexcept {
+            return {this->buffer_.data(), this->size_};
+        }
+        // Drops the consumed chunk and lets the producer refill the buffer.
+        // Returns false once the stream is exhausted.
+        static bool advance(std::coroutine_handle<promise_type> coro) {
+            auto& self = coro.promise();
+            self.size_ = 0;
+            if (coro.done()) {
+                return false;
+            }
+            coro.resume();
+            return self.size_ != 0;
+        }
+    };
+
+    struct iterator {
+        using iterator_concept  = std::input_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = std::span<typename batched_generator::value_type>;
+        using reference         = value_type;
+
+        std::coroutine_handle<promise_type> coro_ = nullptr;
+
+        iterator() = default;
+        explicit iterator(std::coroutine_handle<promise_type> coro) noexcept : coro_(coro) { }
+        iterator& operator++() {
+            if (!promise_type::advance(this->coro_)) {
+                this->coro_ = nullptr;
+            }
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+        [[nodiscard]]
+        friend bool operator==(iterator const& lhs, std::default_sentinel_t) noexcept {
+            return !lhs.coro_;
+        }
+        [[nodiscard]] reference operator*() const noexcept {
+            return this->coro_.promise().chunk();
+        }
+    };
+
+    struct element_iterator {
+        using iterator_concept  = std::input_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = typename batched_generator::value_type;
+        using reference         = value_type&;
+        using pointer           = value_type*;
+
+        std::coroutine_handle<promise_type> coro_ = nullptr;
+        std::size_t index_ = 0;
+
+        element_iterator() = default;
+        explicit element_iterator(std::coroutine_handle<promise_type> coro) noexcept : coro_(coro) { }
+        element_iterator& operator++() {
+            if (++this->index_ == this->coro_.promise().size_) {
+                this->index_ = 0;
+                if (!promise_type::advance(this->coro_)) {
+                    this->coro_ = nullptr;
+                }
+            }
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+        [[nodiscard]]
+        friend bool operator==(element_iterator const& lhs, std::default_sentinel_t) noexcept {
+            return !lhs.coro_;
+        }
+        [[nodiscard]] reference operator*() const noexcept {
+            return this->coro_.promise().buffer_[this->index_];
+        }
+        [[nodiscard]] pointer operator->() const noexcept {
+            return std::addressof(**this);
+        }
+    };
+
+    struct elements_view : std::ranges::view_interface<elements_view> {
+        batched_generator* gen_ = nullptr;
+
+        elements_view() = default;
+        explicit elements_view(batched_generator& gen) noexcept : gen_(&gen) { }
+        [[nodiscard]] element_iterator begin() {
+            return element_iterator{this->gen_->begin().coro_};
+        }
+        [[nodiscard]] std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+    };
+
+    [[nodiscard]] iterator begin() {
+        if (this->coro_ && promise_type::advance(this->coro_)) {
+            return iterator{this->coro_};
+        }
+        return {};
+    }
+    [[nodiscard]] std::default_sentinel_t end() noexcept { return std::default_sentinel; }
+
+    // The view refers to this generator, so it is only available on lvalues.
+    [[nodiscard]] elements_view elements() & noexcept { return elements_view{*this}; }
+    void elements() && = delete;
+
+    explicit batched_generator(promise_type& prom) noexcept
+        : coro_(std::coroutine_handle<promise_type>::from_promise(prom))
+        {
+        }
+    batched_generator() = default;
+    batched_generator(batched_generator&& rhs) noexcept
+        : coro_(std::exchange(rhs.coro_, nullptr))
+        {
+        }
+    ~batched_generator() noexcept {
+        if (this->coro_) {
+            this->coro_.destroy();
+        }
+    }
+    batched_generator& operator=(batched_generator const&) = delete;
+    batched_generator& operator=(batched_generator&& rhs) noexcept {
+        if (this != &rhs) {
+            if (this->coro_) {
+                this->coro_.destroy();
+            }
+            this->coro_ = std::exchange(rhs.coro_, nullptr);
+        }
+        return *this;
+    }
+
+private:
+    std::coroutine_handle<promise_type> coro_ = nullptr;
+};
+
+static_assert(std::input_iterator<batched_generator<int>::iterator>);
+static_assert(std::ranges::input_range<batched_generator<int>::elements_view>);
+static_assert(std::ranges::view<batched_generator<int>::elements_view>);
+
 } // end of namespace std
 
 #endif/*INCLUDE_EXPERIMENTAL_GENERATOR_HPP_4C885F69_96B6_4C47_8ACE_C560BA14D5B3*/
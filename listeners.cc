@@ -0,0 +1,162 @@
+#include <cstring>
+#include <iostream>
+
+#include "listeners.hpp"
+
+namespace wlxx
+{
+
+wl_registry_listener const registry_listener = {
+    .global = [](void* data,
+                 wl_registry* registry_raw,
+                 uint32_t id,
+                 char const* interface,
+                 uint32_t version) {
+        auto g = reinterpret_cast<globals*>(data);
+        if (0 == std::strcmp(interface, wl_compositor_interface.name)) {
+            g->compositor = reinterpret_cast<wl_compositor*>(
+                wl_registry_bind(registry_raw,
+                                 id,
+                                 &wl_compositor_interface,
+                                 version));
+            std::cout << "compositor version: " << version << std::endl;
+        }
+        if (0 == std::strcmp(interface, wl_shell_interface.name)) {
+            g->shell = reinterpret_cast<wl_shell*>(
+                wl_registry_bind(registry_raw,
+                                 id,
+                                 &wl_shell_interface,
+                                 version));
+            std::cout << "shell version: " << version << std::endl;
+        }
+        if (0 == std::strcmp(interface, wl_seat_interface.name)) {
+            g->seat = reinterpret_cast<wl_seat*>(
+                wl_registry_bind(registry_raw,
+                                 id,
+                                 &wl_seat_interface,
+                                 version));//std::min(7u, version));
+            std::cout << "seat version: " << version << std::endl;
+        }
+    },
+    .global_remove = [](auto...) { },
+};
+
+wl_shell_surface_listener const shell_surface_listener = {
+    .ping = [](void*,
+               wl_shell_surface* shell_surface_raw,
+               uint32_t serial) noexcept
+    {
+        wl_shell_surface_pong(shell_surface_raw, serial);
+    },
+    .configure = [](void* data,
+                    wl_shell_surface* shell_surface_raw,
+                    uint32_t edges,
+                    int32_t width,
+                    int32_t height) noexcept
+    {
+        // The render thread owns the EGL window and the viewport.
+        auto state = reinterpret_cast<view_state*>(data);
+        state->resolution[0] = width;
+        state->resolution[1] = height;
+        state->resized.store(true, std::memory_order_release);
+    },
+    .popup_done = [](auto...) noexcept {
+        std::cout << "popup done." << std::endl;
+    },
+};
+
+wl_seat_listener const seat_listener = {
+    .capabilities = [](void*, wl_seat* seat_raw, uint32_t caps) noexcept {
+        if (caps & WL_SEAT_CAPABILITY_POINTER) {
+            std::cout << "pointer device found." << std::endl;
+        }
+        if (caps & WL_SEAT_CAPABILITY_KEYBOARD) {
+            std::cout << "keyboard device found." << std::endl;
+        }
+        if (caps & WL_SEAT_CAPABILITY_TOUCH) {
+            std::cout << "touch device found." << std::endl;
+        }
+        std::cout << "seat capability: " << caps << std::endl;
+    },
+    .name = [](void*, wl_seat* seat_raw, char const* name) noexcept {
+        std::cout << name << std::endl;
+    },
+};
+
+wl_keyboard_listener const keyboard_listener = {
+    .keymap = [](auto...) { },
+    .enter = [](auto...) { },
+    .leave = [](auto...) { },
+    .key = [](void *data,
+              wl_keyboard* keyboard_raw,
+              uint32_t serial,
+              uint32_t time,
+              uint32_t key,
+              uint32_t state)
+    {
+        auto focus = reinterpret_cast<input_focus*>(data);
+        std::cout << (focus->scancode = key) << std::endl;
+    },
+    .modifiers = [](auto...) { },
+    .repeat_info = [](auto...) { },
+};
+
+wl_pointer_listener const pointer_listener = {
+    .enter = [](void* data,
+                wl_pointer* pointer_raw,
+                uint32_t serial,
+                wl_surface* surface_raw,
+                wl_fixed_t sx,
+                wl_fixed_t sy)
+    {
+        std::cout << "pointer entered: "
+                  << wl_fixed_to_int(sx) << ','
+                  << wl_fixed_to_int(sy) << std::endl;
+        auto focus = reinterpret_cast<input_focus*>(data);
+        focus->pointer = surface_raw
+            ? reinterpret_cast<view_state*>(wl_surface_get_user_data(surface_raw))
+            : nullptr;
+    },
+    .leave = [](void* data,
+                wl_pointer* pointer_raw,
+                uint32_t serial,
+                wl_surface* surface_raw)
+    {
+        std::cout << "pointer left." << std::endl;
+        reinterpret_cast<input_focus*>(data)->pointer = nullptr;
+    },
+    .motion = [](void* data,
+                 wl_pointer* pointer_raw,
+                 uint32_t time,
+                 wl_fixed_t sx,
+                 wl_fixed_t sy)
+    {
+        std::cout << "pointer moved: "
+                  << wl_fixed_to_int(sx) << ','
+                  << wl_fixed_to_int(sy) << std::endl;
+        if (auto state = reinterpret_cast<input_focus*>(data)->pointer) {
+            state->pointer[0] = wl_fixed_to_int(sx);
+            state->pointer[1] = state->resolution[1] - wl_fixed_to_int(sy) - 1;
+        }
+    },
+    .button = [](void* data,
+                 wl_pointer* pointer_raw,
+                 uint32_t serial,
+                 uint32_t time,
+                 uint32_t button,
+                 uint32_t state)
+    {
+        std::cout << "pointer button: " << button << ';' << state << std::endl;
+    },
+    .axis = [](void* data,
+               wl_pointer* pointer_raw,
+               uint32_t time,
+               uint32_t axis,
+               wl_fixed_t value)
+    {
+        std::cout << "pointer axis: " << axis << ';' << value << std::endl;
+    },
+    .frame = [](auto...) { },
+};
+
+} // end of namespace wlxx
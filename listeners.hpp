@@ -0,0 +1,44 @@
+#ifndef INCLUDE_LISTENERS_HPP_5A9C3E71_D24B_4E08_8F6A_1B7C0D3E9F52
+#define INCLUDE_LISTENERS_HPP_5A9C3E71_D24B_4E08_8F6A_1B7C0D3E9F52
+
+#include <atomic>
+#include <cstdint>
+
+#include <wayland-client.h>
+
+namespace wlxx
+{
+
+// Globals bound by registry_listener; `data` must point to this.
+struct globals {
+    wl_compositor* compositor = nullptr;
+    wl_shell* shell = nullptr;
+    wl_seat* seat = nullptr;
+};
+
+// Per-surface state written by the listeners on the dispatching thread and
+// read by the window's render thread, hence the atomics.  Surfaces carry a
+// pointer to theirs as wl_surface user data.
+struct view_state {
+    std::atomic<float> resolution[2] = { 800, 600 };
+    std::atomic<float> pointer[2] = { -256, -256 };
+    std::atomic<bool> resized = false;
+};
+
+// Seat-wide input; pointer motion goes to the surface that has pointer
+// focus.  `data` of the keyboard and pointer listeners must point to this.
+struct input_focus {
+    view_state* pointer = nullptr;
+    std::uint32_t scancode = 0;
+};
+
+// libwayland keeps the listener pointer, so these have static storage.
+extern wl_registry_listener const registry_listener;
+extern wl_shell_surface_listener const shell_surface_listener;
+extern wl_seat_listener const seat_listener;
+extern wl_keyboard_listener const keyboard_listener;
+extern wl_pointer_listener const pointer_listener;
+
+} // end of namespace wlxx
+
+#endif/*INCLUDE_LISTENERS_HPP_5A9C3E71_D24B_4E08_8F6A_1B7C0D3E9F52*/
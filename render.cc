@@ -0,0 +1,155 @@
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "render.hpp"
+
+namespace wlxx::render
+{
+
+GLuint create_program() {
+    auto vid = glCreateShader(GL_VERTEX_SHADER);
+    auto fid = glCreateShader(GL_FRAGMENT_SHADER);
+
+#define CODE(x) (#x)
+    auto vcd = CODE(
+        attribute vec4 position;
+        attribute vec2 resolution;
+        attribute vec2 pointer;
+        varying vec2 vert;
+        varying vec2 v_resolution;
+        varying vec2 v_pointer;
+
+        void main(void) {
+            vert = position.xy;
+            v_resolution = resolution;
+            v_pointer = pointer;
+            gl_Position = position;
+        }
+    );
+    auto fcd = CODE(
+        precision mediump float;
+        varying vec2 vert;
+        varying vec2 v_resolution;
+        varying vec2 v_pointer;
+
+        void main(void) {
+            float brightness = length(gl_FragCoord.xy - v_resolution / 2.0) / length(v_resolution);
+            brightness = 1.0 - brightness;
+            gl_FragColor = vec4(0.0, 0.0, brightness, brightness);
+            float radius = length(v_pointer - gl_FragCoord.xy);
+            float touchMark = smoothstep(16.0, 40.0, radius);
+            gl_FragColor *= touchMark;
+        }
+    );
+#undef CODE
+    auto compile = [](auto id, auto code) {
+        glShaderSource(id, 1, &code, nullptr);
+        glCompileShader(id);
+        GLint result;
+        glGetShaderiv(id, GL_COMPILE_STATUS, &result);
+        GLint infoLogLength = 0;
+        glGetShaderiv(id, GL_INFO_LOG_LENGTH, &infoLogLength);
+        if (infoLogLength) {
+            std::vector<char> buf(infoLogLength);
+            glGetShaderInfoLog(id, infoLogLength, nullptr, &buf.front());
+            std::cerr << "<<<" << std::endl;
+            std::cerr << code << std::endl;
+            std::cerr << "---" << std::endl;
+            std::cerr << std::string(buf.begin(), buf.end()).c_str() << std::endl;
+            std::cerr << ">>>" << std::endl;
+        }
+        return result;
+    };
+
+    auto retVertCompilation = compile(vid, vcd);
+    assert(retVertCompilation);
+    auto retFragCompilation = compile(fid, fcd);
+    assert(retFragCompilation);
+
+    auto program = glCreateProgram();
+    assert(program);
+
+    glAttachShader(program, vid);
+    glAttachShader(program, fid);
+
+    glDeleteShader(vid);
+    glDeleteShader(fid);
+
+    glBindAttribLocation(program, 0, "position");
+    glBindAttribLocation(program, 1, "resolution");
+    glBindAttribLocation(program, 2, "pointer");
+    glLinkProgram(program);
+    {
+        GLint linked;
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        assert(linked);
+        GLint length;
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length);
+        assert(0 == length);
+    }
+    return program;
+}
+
+GLuint create_quad() {
+    float vertices_coords[] = {
+        -1, +1, 0,
+        +1, +1, 0,
+        +1, -1, 0,
+        -1, -1, 0,
+    };
+    GLuint quad = 0;
+    glGenBuffers(1, &quad);
+    assert(quad);
+    glBindBuffer(GL_ARRAY_BUFFER, quad);
+    glBufferData(GL_ARRAY_BUFFER, sizeof (vertices_coords), vertices_coords, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return quad;
+}
+
+void draw(GLuint program, GLuint quad,
+          float const (&resolution)[2], float const (&pointer)[2])
+{
+    glClearColor(0.0, 0.7, 0.0, 0.7);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glUseProgram(program);
+    glVertexAttrib2fv(1, resolution);
+    glVertexAttrib2fv(2, pointer);
+    glBindBuffer(GL_ARRAY_BUFFER, quad);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(0);
+    glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+}
+
+void shade(std::span<std::uint32_t> pixels, int width, int height,
+           float const (&pointer)[2])
+{
+    assert(pixels.size() >= std::size_t(width) * height);
+    auto w = float(width);
+    auto h = float(height);
+    auto px = pointer[0];
+    auto py = pointer[1];
+    for (int y = 0; y < height; ++y) {
+        auto row = pixels.data() + std::size_t(y) * width;
+        for (int x = 0; x < width; ++x) {
+            row[x] = shade_pixel(x + 0.5f, y + 0.5f, w, h, px, py);
+        }
+    }
+}
+
+void shade(sycl::queue& queue, std::uint32_t* pixels, int width, int height,
+           float const (&pointer)[2])
+{
+    auto w = float(width);
+    auto h = float(height);
+    auto px = pointer[0];
+    auto py = pointer[1];
+    queue.parallel_for(sycl::range<2>(height, width), [=](sycl::id<2> idx) {
+        auto y = idx[0];
+        auto x = idx[1];
+        pixels[y * width + x] = shade_pixel(x + 0.5f, y + 0.5f, w, h, px, py);
+    }).wait();
+}
+
+} // end of namespace wlxx::render
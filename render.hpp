@@ -0,0 +1,55 @@
+#ifndef INCLUDE_RENDER_HPP_C3F1A8E2_6B5D_4927_A0E4_8D2B7F19C6A3
+#define INCLUDE_RENDER_HPP_C3F1A8E2_6B5D_4927_A0E4_8D2B7F19C6A3
+
+#include <cmath>
+#include <cstdint>
+#include <span>
+
+#include <GLES3/gl3.h>
+#include <CL/sycl.hpp>
+
+namespace wlxx::render
+{
+
+// Compiles and links the full-screen quad program; asserts on failure.
+GLuint create_program();
+
+// Creates the vertex buffer for the full-screen quad.
+GLuint create_quad();
+
+// Draws one frame with `program` and `quad` into the current context.  The
+// program and buffer may be shared between contexts: per-view values are
+// passed as constant vertex attributes, which are context state, rather than
+// uniforms, which would be shared along with the program.
+void draw(GLuint program, GLuint quad,
+          float const (&resolution)[2], float const (&pointer)[2]);
+
+// Host/device mirror of the fragment shader, packed as RGBA8.
+inline std::uint32_t shade_pixel(float x, float y,
+                                 float width, float height,
+                                 float px, float py) noexcept
+{
+    auto dx = x - width / 2.0f;
+    auto dy = y - height / 2.0f;
+    auto brightness = 1.0f - std::sqrt(dx * dx + dy * dy) / std::sqrt(width * width + height * height);
+    auto rx = px - x;
+    auto ry = py - y;
+    auto t = (std::sqrt(rx * rx + ry * ry) - 16.0f) / (40.0f - 16.0f);
+    t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+    auto touch_mark = t * t * (3.0f - 2.0f * t);
+    auto v = static_cast<std::uint32_t>(brightness * touch_mark * 255.0f + 0.5f);
+    return (v << 24) | (v << 16);
+}
+
+// Shades a width x height image on the host, row-major from the bottom row.
+void shade(std::span<std::uint32_t> pixels, int width, int height,
+           float const (&pointer)[2]);
+
+// Same as above with one work-item per pixel; `pixels` must be USM accessible
+// from `queue`'s device.  Blocks until the kernel finishes.
+void shade(sycl::queue& queue, std::uint32_t* pixels, int width, int height,
+           float const (&pointer)[2]);
+
+} // end of namespace wlxx::render
+
+#endif/*INCLUDE_RENDER_HPP_C3F1A8E2_6B5D_4927_A0E4_8D2B7F19C6A3*/
@@ -0,0 +1,238 @@
+#include <cassert>
+#include <stdexcept>
+#include <string>
+
+#include <poll.h>
+
+#include "render.hpp"
+#include "window.hpp"
+
+namespace wlxx
+{
+
+int dispatch(wl_display* display, wl_event_queue* queue, int timeout_ms) {
+    auto prepare = [&] {
+        return queue ? wl_display_prepare_read_queue(display, queue) : wl_display_prepare_read(display);
+    };
+    auto pending = [&] {
+        return queue ? wl_display_dispatch_queue_pending(display, queue) : wl_display_dispatch_pending(display);
+    };
+    if (0 != prepare()) {
+        return pending();
+    }
+    wl_display_flush(display);
+    pollfd fd = { wl_display_get_fd(display), POLLIN, 0 };
+    if (0 < poll(&fd, 1, timeout_ms)) {
+        if (-1 == wl_display_read_events(display)) {
+            return -1;
+        }
+    }
+    else {
+        wl_display_cancel_read(display);
+    }
+    return pending();
+}
+
+namespace
+{
+
+wl_display* connect() {
+    auto display = wl_display_connect(nullptr);
+    if (!display) {
+        throw std::runtime_error("cannot connect to a wayland display");
+    }
+    return display;
+}
+
+template <class WL_TYPE>
+WL_TYPE* require(WL_TYPE* ptr, char const* interface) {
+    if (!ptr) {
+        throw std::runtime_error(std::string(interface) + " is not advertised by the compositor");
+    }
+    return ptr;
+}
+
+wl_callback_listener const frame_listener = {
+    .done = [](void* data, wl_callback* callback_raw, uint32_t time) noexcept {
+        wl_callback_destroy(callback_raw);
+        *reinterpret_cast<wl_callback**>(data) = nullptr;
+    },
+};
+
+} // end of anonymous namespace
+
+connection::connection()
+    : display_(attach_unique(connect()))
+    , registry_(attach_unique(wl_display_get_registry(this->display_.get())))
+    , compositor_(attach_unique(require(this->bind().compositor, wl_compositor_interface.name)))
+    , shell_(attach_unique(require(this->globals_.shell, wl_shell_interface.name)))
+    , seat_(this->globals_.seat ? attach_unique(this->globals_.seat) : decltype (this->seat_){})
+{
+}
+
+globals& connection::bind() {
+    auto r = wl_registry_add_listener(this->registry_.get(), &registry_listener, &this->globals_);
+    assert(0 == r);
+    wl_display_roundtrip(this->display_.get());
+    return this->globals_;
+}
+
+egl_shared::egl_shared(wl_display* display)
+    : display_(eglGetDisplay(display))
+{
+    assert(this->display_);
+    auto eglInitialized = eglInitialize(this->display_, nullptr, nullptr);
+    assert(eglInitialized);
+    auto eglBound = eglBindAPI(EGL_OPENGL_ES_API);
+    assert(eglBound);
+    EGLint attributes[] = {
+        EGL_LEVEL, 0,
+        EGL_SURFACE_TYPE, EGL_WINDOW_BIT,
+        EGL_RED_SIZE,   8,
+        EGL_GREEN_SIZE, 8,
+        EGL_BLUE_SIZE,  8,
+        EGL_ALPHA_SIZE, 8,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT,
+        EGL_NONE,
+    };
+    EGLint num_config;
+    auto eglConfig = eglChooseConfig(this->display_, attributes, &this->config_, 1, &num_config);
+    assert(eglConfig);
+    EGLint contextAttributes[] = {
+        EGL_CONTEXT_CLIENT_VERSION, 2,
+        EGL_NONE,
+    };
+    this->context_ = eglCreateContext(this->display_,
+                                      this->config_,
+                                      EGL_NO_CONTEXT,
+                                      contextAttributes);
+    assert(this->context_);
+
+    // Needs EGL_KHR_surfaceless_context; the root context never draws.
+    auto eglMadeCurrent = eglMakeCurrent(this->display_,
+                                         EGL_NO_SURFACE,
+                                         EGL_NO_SURFACE,
+                                         this->context_);
+    assert(eglMadeCurrent);
+    this->program_ = render::create_program();
+    this->quad_ = render::create_quad();
+    glFinish();
+    eglMakeCurrent(this->display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+egl_shared::~egl_shared() {
+    eglMakeCurrent(this->display_, EGL_NO_SURFACE, EGL_NO_SURFACE, this->context_);
+    glDeleteBuffers(1, &this->quad_);
+    glDeleteProgram(this->program_);
+    eglMakeCurrent(this->display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroyContext(this->display_, this->context_);
+    eglTerminate(this->display_);
+}
+
+window::window(connection& conn, egl_shared& shared, int width, int height, char const* title)
+    : conn_(conn)
+    , shared_(shared)
+    , surface_(attach_unique(wl_compositor_create_surface(conn.compositor())))
+    , shell_surface_(attach_unique(wl_shell_get_shell_surface(conn.shell(), this->surface_.get())))
+    , egl_window_(attach_unique(wl_egl_window_create(this->surface_.get(), width, height),
+                                wl_egl_window_destroy))
+    , queue_(attach_unique(wl_display_create_queue(conn.display()), wl_event_queue_destroy))
+    , surface_wrapper_(attach_unique(reinterpret_cast<wl_surface*>(wl_proxy_create_wrapper(this->surface_.get())),
+                                     wl_proxy_wrapper_destroy))
+{
+    this->state_.resolution[0] = width;
+    this->state_.resolution[1] = height;
+    wl_proxy_set_queue(reinterpret_cast<wl_proxy*>(this->surface_wrapper_.get()), this->queue_.get());
+    wl_surface_set_user_data(this->surface_.get(), &this->state_);
+    {
+        auto r = wl_shell_surface_add_listener(this->shell_surface_.get(),
+                                               &shell_surface_listener,
+                                               &this->state_);
+        assert(0 == r);
+    }
+    wl_shell_surface_set_title(this->shell_surface_.get(), title);
+    wl_shell_surface_set_toplevel(this->shell_surface_.get());
+
+    this->egl_surface_ = eglCreateWindowSurface(shared.display(),
+                                                shared.config(),
+                                                reinterpret_cast<EGLNativeWindowType>(this->egl_window_.get()),
+                                                nullptr);
+    assert(this->egl_surface_);
+    EGLint contextAttributes[] = {
+        EGL_CONTEXT_CLIENT_VERSION, 2,
+        EGL_NONE,
+    };
+    this->context_ = eglCreateContext(shared.display(),
+                                      shared.config(),
+                                      shared.context(),
+                                      contextAttributes);
+    assert(this->context_);
+}
+
+window::~window() {
+    this->stop();
+    eglDestroyContext(this->shared_.display(), this->context_);
+    eglDestroySurface(this->shared_.display(), this->egl_surface_);
+}
+
+void window::start(bool throttle) {
+    assert(!this->thread_.joinable());
+    this->throttle_ = throttle;
+    this->running_ = true;
+    this->thread_ = std::thread(&window::render, this);
+}
+
+void window::stop() {
+    this->running_ = false;
+    if (this->thread_.joinable()) {
+        this->thread_.join();
+    }
+}
+
+void window::render() {
+    auto display = this->shared_.display();
+    eglBindAPI(EGL_OPENGL_ES_API);
+    auto eglMadeCurrent = eglMakeCurrent(display,
+                                         this->egl_surface_,
+                                         this->egl_surface_,
+                                         this->context_);
+    assert(eglMadeCurrent);
+    // Pacing is done with our own frame callbacks so a hidden or slow window
+    // never blocks inside eglSwapBuffers.
+    eglSwapInterval(display, 0);
+    glFrontFace(GL_CW);
+
+    while (this->running_.load(std::memory_order_relaxed)) {
+        if (this->state_.resized.exchange(false, std::memory_order_acquire)) {
+            auto width = static_cast<int>(this->state_.resolution[0]);
+            auto height = static_cast<int>(this->state_.resolution[1]);
+            wl_egl_window_resize(this->egl_window_.get(), width, height, 0, 0);
+            glViewport(0, 0, width, height);
+        }
+        float resolution[2] = { this->state_.resolution[0], this->state_.resolution[1] };
+        float pointer[2] = { this->state_.pointer[0], this->state_.pointer[1] };
+        render::draw(this->shared_.program(), this->shared_.quad(), resolution, pointer);
+        if (this->throttle_) {
+            this->frame_ = wl_surface_frame(this->surface_wrapper_.get());
+            wl_callback_add_listener(this->frame_, &frame_listener, &this->frame_);
+        }
+        if (EGL_FALSE == eglSwapBuffers(display, this->egl_surface_)) {
+            // Surface or connection lost; running() reports it to the owner.
+            this->running_ = false;
+            break;
+        }
+        this->frames_.fetch_add(1, std::memory_order_relaxed);
+        while (this->frame_ && this->running_.load(std::memory_order_relaxed)) {
+            if (-1 == wlxx::dispatch(this->conn_.display(), this->queue_.get(), 100)) {
+                this->running_ = false;
+            }
+        }
+    }
+    if (this->frame_) {
+        wl_callback_destroy(this->frame_);
+        this->frame_ = nullptr;
+    }
+    eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+} // end of namespace wlxx
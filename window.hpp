@@ -0,0 +1,115 @@
+#ifndef INCLUDE_WINDOW_HPP_E84A2D6C_1F3B_4C95_9B07_6A5D3C8E2F41
+#define INCLUDE_WINDOW_HPP_E84A2D6C_1F3B_4C95_9B07_6A5D3C8E2F41
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+
+#include <wayland-client.h>
+#include <wayland-egl.h>
+
+#include <EGL/egl.h>
+#include <GLES3/gl3.h>
+
+#include "attach_unique.hpp"
+#include "listeners.hpp"
+
+namespace wlxx
+{
+
+// Dispatches `queue` (the default queue when null), waiting up to
+// `timeout_ms` for events to arrive.  Safe to call from several threads on
+// distinct queues.  Returns the number of events dispatched, or -1 on error.
+int dispatch(wl_display* display, wl_event_queue* queue, int timeout_ms);
+
+// Display connection and the globals every window needs.
+class connection {
+public:
+    connection();
+
+    wl_display* display() const noexcept { return this->display_.get(); }
+    wl_compositor* compositor() const noexcept { return this->compositor_.get(); }
+    wl_shell* shell() const noexcept { return this->shell_.get(); }
+    wl_seat* seat() const noexcept { return this->seat_.get(); }   // may be null
+
+    int dispatch(int timeout_ms) { return wlxx::dispatch(this->display(), nullptr, timeout_ms); }
+
+private:
+    globals& bind();
+
+    decltype (attach_unique(std::declval<wl_display*>())) display_;
+    decltype (attach_unique(std::declval<wl_registry*>())) registry_;
+    globals globals_;   // registry_listener data, so it lives as long as registry_
+    decltype (attach_unique(std::declval<wl_compositor*>())) compositor_;
+    decltype (attach_unique(std::declval<wl_shell*>())) shell_;
+    decltype (attach_unique(std::declval<wl_seat*>())) seat_;
+};
+
+// EGL display and a surfaceless root context owning the GL objects that every
+// window context shares: the compiled program and the quad buffer.
+class egl_shared {
+public:
+    explicit egl_shared(wl_display* display);
+    ~egl_shared();
+    egl_shared(egl_shared const&) = delete;
+    egl_shared& operator=(egl_shared const&) = delete;
+
+    EGLDisplay display() const noexcept { return this->display_; }
+    EGLConfig config() const noexcept { return this->config_; }
+    EGLContext context() const noexcept { return this->context_; }
+    GLuint program() const noexcept { return this->program_; }
+    GLuint quad() const noexcept { return this->quad_; }
+
+private:
+    EGLDisplay display_ = EGL_NO_DISPLAY;
+    EGLConfig config_ = nullptr;
+    EGLContext context_ = EGL_NO_CONTEXT;
+    GLuint program_ = 0;
+    GLuint quad_ = 0;
+};
+
+// A toplevel surface with its own EGL surface and context and a render thread
+// that draws and swaps independently of the other windows.  Configure and
+// input events are still dispatched on the connection's default queue; frame
+// callbacks go to a private queue dispatched by the render thread.
+class window {
+public:
+    window(connection& conn, egl_shared& shared, int width, int height, char const* title);
+    ~window();
+    window(window const&) = delete;
+    window& operator=(window const&) = delete;
+
+    // With `throttle`, each frame waits for the compositor's frame callback;
+    // without it, frames are rendered as fast as the swap chain allows.
+    void start(bool throttle = true);
+    void stop();
+
+    [[nodiscard]] bool running() const noexcept { return this->running_.load(std::memory_order_relaxed); }
+    [[nodiscard]] std::uint64_t frames() const noexcept { return this->frames_.load(std::memory_order_relaxed); }
+    [[nodiscard]] view_state& state() noexcept { return this->state_; }
+
+private:
+    void render();
+
+    connection& conn_;
+    egl_shared& shared_;
+    view_state state_;
+    decltype (attach_unique(std::declval<wl_surface*>())) surface_;
+    decltype (attach_unique(std::declval<wl_shell_surface*>())) shell_surface_;
+    std::unique_ptr<wl_egl_window, void (*)(wl_egl_window*)> egl_window_;
+    std::unique_ptr<wl_event_queue, void (*)(wl_event_queue*)> queue_;
+    std::unique_ptr<wl_surface, void (*)(void*)> surface_wrapper_;   // surface_ proxied onto queue_
+    EGLSurface egl_surface_ = EGL_NO_SURFACE;
+    EGLContext context_ = EGL_NO_CONTEXT;
+    wl_callback* frame_ = nullptr;
+    bool throttle_ = true;
+    std::atomic<bool> running_ = false;
+    std::atomic<std::uint64_t> frames_ = 0;
+    std::thread thread_;
+};
+
+} // end of namespace wlxx
+
+#endif/*INCLUDE_WINDOW_HPP_E84A2D6C_1F3B_4C95_9B07_6A5D3C8E2F41*/